@@ -318,7 +318,20 @@ static void freeze_write_map(freeze_writer_t *self, const mp_map_t *map, bool mu
     freeze_align(self, __alignof__(mp_map_t));
     freeze_write_size(self, fmap.header);
     freeze_write_size(self, map->alloc);
-    freeze_write_obj_array(self, (mp_obj_t *)map->table, 2 * map->alloc, mutable);
+
+    // the table may be followed by an index of positions in it, see py/map.c
+    flash_ptr_t ftable = 0;
+    if (map->table) {
+        size_t size = mp_map_table_size(map);
+        ftable = freeze_allocate(self, size, __alignof__(mp_obj_t), mutable);
+        flash_ptr_t ret = freeze_seek(self, ftable);
+        for (size_t i = 0; i < 2 * map->alloc; i++) {
+            freeze_write_obj(self, ((mp_obj_t *)map->table)[i]);
+        }
+        freeze_write(self, (const uint8_t *)&map->table[map->alloc], size - map->alloc * sizeof(mp_map_elem_t));
+        freeze_seek(self, ret);
+    }
+    freeze_write_fptr(self, ftable);
 }
 
 static void freeze_write_immutable_dict_ptr(freeze_writer_t *self, const mp_obj_dict_t *dict) {
@@ -416,6 +429,15 @@ static void freeze_write_fun_bc(freeze_writer_t *self, const mp_obj_fun_bc_t *fu
     freeze_write_fptr(self, frc);
 
     freeze_write_size(self, fun_bc->n_extra_args);
+    #if MICROPY_OPT_INLINE_CACHE
+    // the VM can't attach a cache to a function in flash
+    freeze_write_intptr(self, (uintptr_t)&mp_inline_cache_disabled);
+    #endif
+    #if MICROPY_OPT_NATIVE_TIERING
+    // nor count its calls and promote it
+    freeze_write_size(self, 0);
+    freeze_write_obj(self, mp_const_none);
+    #endif
 
     for (size_t i = 0; i < fun_bc->n_extra_args; i++) {
         if (mp_obj_is_dict_or_ordereddict(fun_bc->extra_args[i])) {
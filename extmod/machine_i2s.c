@@ -431,6 +431,7 @@ static mp_obj_t machine_i2s_irq(mp_obj_t self_in, mp_obj_t handler) {
     }
 
     self->callback_for_non_blocking = handler;
+    gc_write_barrier(self);
 
     mp_machine_i2s_irq_update(self);
 
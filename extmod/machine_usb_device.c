@@ -224,6 +224,7 @@ static mp_obj_t usb_device_config(size_t n_args, const mp_obj_t *pos_args, mp_ma
     self->reset_cb = args[ARG_reset_cb].u_obj;
     self->control_xfer_cb = args[ARG_control_xfer_cb].u_obj;
     self->xfer_cb = args[ARG_xfer_cb].u_obj;
+    gc_write_barrier(self);
 
     return mp_const_none;
 }
@@ -322,6 +323,7 @@ static void usb_device_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
             // Note: this value should be one of the BUILTIN_nnn constants,
             // but not checked here to save code size in a low level API
             self->builtin_driver = dest[1];
+            gc_write_barrier(self);
             dest[0] = MP_OBJ_NULL;
         }
     }
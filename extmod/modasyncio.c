@@ -25,6 +25,7 @@
  */
 
 #include "py/runtime.h"
+#include "py/gc.h"
 #include "py/smallint.h"
 #include "py/pairheap.h"
 #include "py/mphal.h"
@@ -121,8 +122,10 @@ static mp_obj_t task_queue_push(size_t n_args, const mp_obj_t *args) {
     } else {
         assert(mp_obj_is_small_int(args[2]));
         task->ph_key = args[2];
+        gc_write_barrier(task);
     }
     self->heap = (mp_obj_task_t *)mp_pairheap_push(task_lt, TASK_PAIRHEAP(self->heap), TASK_PAIRHEAP(task));
+    gc_write_barrier(self);
     #if MICROPY_PY_ASYNCIO_TASK_QUEUE_PUSH_CALLBACK
     if (self->push_callback != MP_OBJ_NULL) {
         mp_call_function_1(self->push_callback, MP_OBJ_NEW_SMALL_INT(0));
@@ -139,6 +142,7 @@ static mp_obj_t task_queue_pop(mp_obj_t self_in) {
         mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("empty heap"));
     }
     self->heap = (mp_obj_task_t *)mp_pairheap_pop(task_lt, &self->heap->pairheap);
+    gc_write_barrier(self);
     return MP_OBJ_FROM_PTR(head);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(task_queue_pop_obj, task_queue_pop);
@@ -147,6 +151,7 @@ static mp_obj_t task_queue_remove(mp_obj_t self_in, mp_obj_t task_in) {
     mp_obj_task_queue_t *self = MP_OBJ_TO_PTR(self_in);
     mp_obj_task_t *task = MP_OBJ_TO_PTR(task_in);
     self->heap = (mp_obj_task_t *)mp_pairheap_delete(task_lt, &self->heap->pairheap, &task->pairheap);
+    gc_write_barrier(self);
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(task_queue_remove_obj, task_queue_remove);
@@ -234,6 +239,7 @@ static mp_obj_t task_cancel(mp_obj_t self_in) {
     }
 
     self->data = mp_obj_dict_get(mp_asyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_CancelledError));
+    gc_write_barrier(self);
 
     return mp_const_true;
 }
@@ -262,9 +268,11 @@ static void task_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
         // Store
         if (attr == MP_QSTR_data) {
             self->data = dest[1];
+            gc_write_barrier(self);
             dest[0] = MP_OBJ_NULL;
         } else if (attr == MP_QSTR_state) {
             self->state = dest[1];
+            gc_write_barrier(self);
             dest[0] = MP_OBJ_NULL;
         }
     }
@@ -279,6 +287,7 @@ static mp_obj_t task_getiter(mp_obj_t self_in, mp_obj_iter_buf_t *iter_buf) {
     } else if (self->state == TASK_STATE_RUNNING_NOT_WAITED_ON) {
         // Allocate the waiting queue.
         self->state = task_queue_make_new(&task_queue_type, 0, 0, NULL);
+        gc_write_barrier(self);
     } else if (mp_obj_get_type(self->state) != &task_queue_type) {
         // Task has state used for another purpose, so can't also wait on it.
         mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("can't wait"));
@@ -298,6 +307,7 @@ static mp_obj_t task_iternext(mp_obj_t self_in) {
         task_queue_push(2, args);
         // Set calling task's data to this task that it waits on, to double-link it.
         ((mp_obj_task_t *)MP_OBJ_TO_PTR(cur_task))->data = self_in;
+        gc_write_barrier(MP_OBJ_TO_PTR(cur_task));
     }
     return mp_const_none;
 }
@@ -439,6 +439,7 @@ static mp_obj_t bluetooth_ble_irq(mp_obj_t self_in, mp_obj_t handler_in) {
     mp_obj_bluetooth_ble_t *o = MP_OBJ_TO_PTR(MP_STATE_VM(bluetooth));
     o->irq_handler = handler_in;
     MICROPY_PY_BLUETOOTH_EXIT
+    gc_write_barrier(o);
 
     return mp_const_none;
 }
@@ -203,6 +203,7 @@ static mp_obj_t btree_init_iter(size_t n_args, const mp_obj_t *args, byte type)
                 self->next_flags = type | MP_OBJ_SMALL_INT_VALUE(args[3]);
             }
         }
+        gc_write_barrier(self);
     }
     return args[0];
 }
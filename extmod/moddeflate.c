@@ -108,6 +108,7 @@ static bool deflateio_init_read(mp_obj_deflateio_t *self) {
     mp_get_stream_raise(self->stream, MP_STREAM_OP_READ);
 
     self->read = m_new_obj(mp_obj_deflateio_read_t);
+    gc_write_barrier(self);
     memset(&self->read->decomp, 0, sizeof(self->read->decomp));
     self->read->decomp.source_read_data = self;
     self->read->decomp.source_read_cb = deflateio_read_stream;
@@ -144,6 +145,7 @@ static bool deflateio_init_read(mp_obj_deflateio_t *self) {
 
     size_t window_len = 1 << wbits;
     self->read->window = m_new(uint8_t, window_len);
+    gc_write_barrier(self->read);
 
     uzlib_uncompress_init(&self->read->decomp, self->read->window, window_len);
 
@@ -169,6 +171,7 @@ static bool deflateio_init_write(mp_obj_deflateio_t *self) {
     const mp_stream_p_t *stream = mp_get_stream_raise(self->stream, MP_STREAM_OP_WRITE);
 
     self->write = m_new_obj(mp_obj_deflateio_write_t);
+    gc_write_barrier(self);
     self->write->input_len = 0;
 
     int wbits = self->window_bits;
@@ -178,6 +181,7 @@ static bool deflateio_init_write(mp_obj_deflateio_t *self) {
     }
     size_t window_len = 1 << wbits;
     self->write->window = m_new(uint8_t, window_len);
+    gc_write_barrier(self->write);
 
     uzlib_lz77_init(&self->write->lz77, self->write->window, window_len);
     self->write->lz77.dest_write_data = self;
@@ -997,6 +997,7 @@ static mp_obj_t lwip_socket_listen(size_t n_args, const mp_obj_t *args) {
     } else {
         socket->incoming.connection.alloc = backlog;
         socket->incoming.connection.tcp.array = m_new0(struct tcp_pcb *, backlog);
+        gc_write_barrier(socket);
     }
     socket->incoming.connection.iget = 0;
     socket->incoming.connection.iput = 0;
@@ -1409,6 +1410,7 @@ static mp_obj_t lwip_socket_setsockopt(size_t n_args, const mp_obj_t *args) {
             socket->callback = MP_OBJ_NULL;
         } else {
             socket->callback = args[3];
+            gc_write_barrier(socket);
         }
         return mp_const_none;
     }
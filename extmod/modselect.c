@@ -583,6 +583,7 @@ static mp_obj_t poll_ipoll(size_t n_args, const mp_obj_t *args) {
 
     if (self->ret_tuple == MP_OBJ_NULL) {
         self->ret_tuple = mp_obj_new_tuple(2, NULL);
+        gc_write_barrier(self);
     }
 
     int n_ready = poll_poll_internal(n_args, args);
@@ -39,6 +39,7 @@ static mp_obj_t select_poll_register(size_t n_args, const mp_obj_t *args) {
     }
     i = self->nfds++;
     self->fds = m_realloc(self->fds, self->nfds * sizeof(struct pollfd));
+    gc_write_barrier(self);
     self->fds[i].fd = fd;
 
 found:
@@ -179,6 +179,7 @@ static void ssl_context_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
 static void ssl_context_load_key(mp_obj_ssl_context_t *self, mp_obj_t key_obj, mp_obj_t cert_obj) {
     self->key = key_obj;
     self->cert = cert_obj;
+    gc_write_barrier(self);
 }
 
 // SSLContext.load_cert_chain(certfile, keyfile)
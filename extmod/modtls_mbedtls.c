@@ -323,10 +323,12 @@ static void ssl_context_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
         } else if (attr == MP_QSTR_ecdsa_sign_callback) {
             dest[0] = MP_OBJ_NULL;
             self->ecdsa_sign_callback = dest[1];
+            gc_write_barrier(self);
         #endif
         } else if (attr == MP_QSTR_verify_callback) {
             dest[0] = MP_OBJ_NULL;
             self->handler = dest[1];
+            gc_write_barrier(self);
         }
     }
 }
@@ -370,6 +372,7 @@ static mp_obj_t ssl_context_set_ciphers(mp_obj_t self_in, mp_obj_t ciphersuite)
 
     // Parse list of ciphers.
     ssl_context->ciphersuites = m_new(int, len + 1);
+    gc_write_barrier(ssl_context);
     for (size_t i = 0; i < len; ++i) {
         const char *ciphername = mp_obj_str_get_str(ciphers[i]);
         const int id = mbedtls_ssl_get_ciphersuite_id(ciphername);
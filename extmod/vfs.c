@@ -259,6 +259,8 @@ mp_obj_t mp_vfs_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args
         vfsp = &(*vfsp)->next;
     }
     *vfsp = vfs;
+    gc_write_barrier(vfsp);
+    mp_import_cache_clear();
 
     return mp_const_none;
 }
@@ -276,6 +278,7 @@ mp_obj_t mp_vfs_umount(mp_obj_t mnt_in) {
         if ((mnt_str != NULL && mnt_len == (*vfsp)->len && !memcmp(mnt_str, (*vfsp)->str, mnt_len)) || (*vfsp)->obj == mnt_in) {
             vfs = *vfsp;
             *vfsp = (*vfsp)->next;
+            gc_write_barrier(vfsp);
             break;
         }
     }
@@ -289,6 +292,8 @@ mp_obj_t mp_vfs_umount(mp_obj_t mnt_in) {
         MP_STATE_VM(vfs_cur) = MP_VFS_ROOT;
     }
 
+    mp_import_cache_clear();
+
     // call the underlying object to do any unmounting operation
     mp_vfs_proxy_call(vfs, MP_QSTR_umount, 0, NULL);
 
@@ -318,7 +323,12 @@ mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
     #endif
 
     mp_vfs_mount_t *vfs = lookup_path(args[ARG_file].u_obj, &args[ARG_file].u_obj);
-    return mp_vfs_proxy_call(vfs, MP_QSTR_open, 2, (mp_obj_t *)&args);
+    mp_obj_t file = mp_vfs_proxy_call(vfs, MP_QSTR_open, 2, (mp_obj_t *)&args);
+    if (strpbrk(mp_obj_str_get_str(args[ARG_mode].u_obj), "wax+") != NULL) {
+        // the file may have been created
+        mp_import_cache_clear();
+    }
+    return file;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(mp_vfs_open_obj, 0, mp_vfs_open);
 
@@ -341,6 +351,8 @@ mp_obj_t mp_vfs_chdir(mp_obj_t path_in) {
         mp_vfs_proxy_call(vfs, MP_QSTR_chdir, 1, &path_out);
     }
     MP_STATE_VM(vfs_cur) = vfs;
+    // relative paths in sys.path now refer to different directories
+    mp_import_cache_clear();
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_chdir_obj, mp_vfs_chdir);
@@ -449,14 +461,18 @@ mp_obj_t mp_vfs_mkdir(mp_obj_t path_in) {
     if (vfs == MP_VFS_ROOT || (vfs != MP_VFS_NONE && !strcmp(mp_obj_str_get_str(path_out), "/"))) {
         mp_raise_OSError(MP_EEXIST);
     }
-    return mp_vfs_proxy_call(vfs, MP_QSTR_mkdir, 1, &path_out);
+    mp_obj_t ret = mp_vfs_proxy_call(vfs, MP_QSTR_mkdir, 1, &path_out);
+    mp_import_cache_clear();
+    return ret;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_mkdir_obj, mp_vfs_mkdir);
 
 mp_obj_t mp_vfs_remove(mp_obj_t path_in) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_path(path_in, &path_out);
-    return mp_vfs_proxy_call(vfs, MP_QSTR_remove, 1, &path_out);
+    mp_obj_t ret = mp_vfs_proxy_call(vfs, MP_QSTR_remove, 1, &path_out);
+    mp_import_cache_clear();
+    return ret;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_remove_obj, mp_vfs_remove);
 
@@ -468,14 +484,18 @@ mp_obj_t mp_vfs_rename(mp_obj_t old_path_in, mp_obj_t new_path_in) {
         // can't rename across filesystems
         mp_raise_OSError(MP_EPERM);
     }
-    return mp_vfs_proxy_call(old_vfs, MP_QSTR_rename, 2, args);
+    mp_obj_t ret = mp_vfs_proxy_call(old_vfs, MP_QSTR_rename, 2, args);
+    mp_import_cache_clear();
+    return ret;
 }
 MP_DEFINE_CONST_FUN_OBJ_2(mp_vfs_rename_obj, mp_vfs_rename);
 
 mp_obj_t mp_vfs_rmdir(mp_obj_t path_in) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_path(path_in, &path_out);
-    return mp_vfs_proxy_call(vfs, MP_QSTR_rmdir, 1, &path_out);
+    mp_obj_t ret = mp_vfs_proxy_call(vfs, MP_QSTR_rmdir, 1, &path_out);
+    mp_import_cache_clear();
+    return ret;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_rmdir_obj, mp_vfs_rmdir);
 
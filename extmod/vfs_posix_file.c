@@ -75,6 +75,10 @@ mp_obj_t mp_vfs_posix_file_open(const mp_obj_type_t *type, mp_obj_t file_in, mp_
                 mode_rw = O_WRONLY;
                 mode_x = O_CREAT | O_TRUNC;
                 break;
+            case 'x':
+                mode_rw = O_WRONLY;
+                mode_x = O_CREAT | O_EXCL;
+                break;
             case 'a':
                 mode_rw = O_WRONLY;
                 mode_x = O_CREAT | O_APPEND;
@@ -107,4 +107,77 @@ void mp_reader_new_file(mp_reader_t *reader, qstr filename) {
     reader->close = mp_reader_vfs_close;
 }
 
+#if MICROPY_READER_VFS_MMAP
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Size of the address range reserved for files loaded by
+// mp_reader_new_file_mmap.  Memory is only used for the files in it.
+#ifndef MICROPY_READER_VFS_MMAP_ARENA_SIZE
+#define MICROPY_READER_VFS_MMAP_ARENA_SIZE (64 * 1024 * 1024)
+#endif
+
+// Read the whole file into memory outside the GC heap and create a memory
+// reader for it, whose contents can then be used in place.  The file is read
+// rather than mapped, so that loaded code doesn't change (or fault) if the
+// file is rewritten or truncated.  The memory is writable so that the VM can
+// still quicken bytecode in it.  Files are put one after another in a single
+// anonymous mapping, which is made the first time and never removed because
+// loaded code keeps referring to it, so mp_reader_is_mmap_ptr is one range
+// check.  Returns false if the file can't be loaded this way (eg it isn't on
+// the posix filesystem, or the mapping is full), in which case the caller
+// should fall back to mp_reader_new_file.
+bool mp_reader_new_file_mmap(mp_reader_t *reader, qstr filename) {
+    if (MP_STATE_VM(reader_mmap_arena) == NULL) {
+        void *arena = mmap(NULL, MICROPY_READER_VFS_MMAP_ARENA_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (arena == MAP_FAILED) {
+            return false;
+        }
+        MP_STATE_VM(reader_mmap_arena) = arena;
+        MP_STATE_VM(reader_mmap_top) = arena;
+    }
+
+    mp_obj_t args[2] = {
+        MP_OBJ_NEW_QSTR(filename),
+        MP_OBJ_NEW_QSTR(MP_QSTR_rb),
+    };
+    mp_obj_t file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+
+    const mp_stream_p_t *stream_p = mp_get_stream(file);
+    int errcode = 0;
+    mp_uint_t fd = stream_p->ioctl(file, MP_STREAM_GET_FILENO, 0, &errcode);
+    byte *buf = MP_STATE_VM(reader_mmap_top);
+    size_t len = 0;
+    struct stat st;
+    if (fd != MP_STREAM_ERROR && fstat(fd, &st) == 0 && st.st_size > 0
+        && (size_t)st.st_size <= (size_t)(MP_STATE_VM(reader_mmap_arena) + MICROPY_READER_VFS_MMAP_ARENA_SIZE - buf)) {
+        // Take the space before reading, which may release the GIL.  The next
+        // file is kept aligned like the start of a page would be.
+        MP_STATE_VM(reader_mmap_top) = buf + ((st.st_size + 15) & ~(size_t)15);
+        len = mp_stream_rw(file, buf, st.st_size, &errcode, MP_STREAM_RW_READ);
+        if (errcode != 0) {
+            len = 0;
+        }
+    }
+    mp_stream_close(file);
+    if (len == 0) {
+        return false;
+    }
+
+    mp_reader_new_mem(reader, buf, len, MP_READER_IS_ROM);
+    return true;
+}
+
+// Whether ptr points into a file loaded by mp_reader_new_file_mmap, which may
+// be written to.
+bool mp_reader_is_mmap_ptr(const void *ptr) {
+    return (const byte *)ptr >= MP_STATE_VM(reader_mmap_arena) && (const byte *)ptr < MP_STATE_VM(reader_mmap_top);
+}
+
+MP_REGISTER_ROOT_POINTER(byte *reader_mmap_arena);
+MP_REGISTER_ROOT_POINTER(byte *reader_mmap_top);
+
+#endif // MICROPY_READER_VFS_MMAP
+
 #endif // MICROPY_READER_VFS
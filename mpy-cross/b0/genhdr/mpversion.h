@@ -0,0 +1,4 @@
+// This file was generated by py/makeversionhdr.py
+#define MICROPY_GIT_TAG "af29e83-dirty"
+#define MICROPY_GIT_HASH "af29e83"
+#define MICROPY_BUILD_DATE "2026-10-16"
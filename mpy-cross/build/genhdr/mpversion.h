@@ -0,0 +1,4 @@
+// This file was generated by py/makeversionhdr.py
+#define MICROPY_GIT_TAG "d1594e0-dirty"
+#define MICROPY_GIT_HASH "d1594e0"
+#define MICROPY_BUILD_DATE "2026-10-17"